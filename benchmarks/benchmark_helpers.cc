@@ -0,0 +1,212 @@
+#include "benchmark_helpers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "absl/memory/memory.h"
+#include "cartographer/common/configuration_file_resolver.h"
+#include "cartographer/common/lua_parameter_dictionary_test_helpers.h"
+#include "cartographer/common/math.h"
+#include "cartographer/mapping/2d/map_limits.h"
+#include "cartographer/mapping/2d/probability_grid_range_data_inserter_2d.h"
+#include "cartographer/mapping/2d/xy_index.h"
+#include "cartographer/transform/transform.h"
+
+namespace cartographer {
+namespace benchmarks {
+namespace {
+
+constexpr double kMinX = -8.;
+constexpr double kMaxX = 12.;
+constexpr double kMinY = -6.;
+constexpr double kMaxY = 9.;
+constexpr double kTrajectoryRadius = 2.5;
+// Same as in submap_2d.cc.
+constexpr int kInitialSubmapSize = 100;
+
+struct Pillar {
+  double x;
+  double y;
+  double radius;
+};
+
+constexpr Pillar kPillars[] = {{3., 2., 0.5}, {-4., 5., 0.8}, {7., -3., 0.3}};
+
+// Returns the distance from 'origin', which must be inside the room, to the
+// first obstacle along the unit vector 'direction'.
+double CastRay(const Eigen::Vector2d& origin,
+               const Eigen::Vector2d& direction) {
+  double range = std::numeric_limits<double>::infinity();
+  if (direction.x() > 0.) {
+    range = std::min(range, (kMaxX - origin.x()) / direction.x());
+  } else if (direction.x() < 0.) {
+    range = std::min(range, (kMinX - origin.x()) / direction.x());
+  }
+  if (direction.y() > 0.) {
+    range = std::min(range, (kMaxY - origin.y()) / direction.y());
+  } else if (direction.y() < 0.) {
+    range = std::min(range, (kMinY - origin.y()) / direction.y());
+  }
+  for (const Pillar& pillar : kPillars) {
+    const Eigen::Vector2d offset = origin - Eigen::Vector2d(pillar.x, pillar.y);
+    const double b = offset.dot(direction);
+    const double discriminant =
+        b * b - offset.squaredNorm() + pillar.radius * pillar.radius;
+    if (discriminant < 0.) {
+      continue;
+    }
+    const double distance = -b - std::sqrt(discriminant);
+    if (distance > 0.) {
+      range = std::min(range, distance);
+    }
+  }
+  return range;
+}
+
+// Returns the returns of a scan at 'pose' in the sensor frame. If 'prng' is
+// not null, Gaussian noise with 'range_stddev' is added to the ranges.
+std::vector<Eigen::Vector3f> CastScan(const transform::Rigid2d& pose,
+                                      const int num_points,
+                                      const double range_stddev = 0.,
+                                      std::mt19937* const prng = nullptr) {
+  std::vector<Eigen::Vector3f> returns;
+  returns.reserve(num_points);
+  for (int i = 0; i != num_points; ++i) {
+    const double angle = 2. * M_PI * i / num_points;
+    const double world_angle = pose.rotation().angle() + angle;
+    double range =
+        CastRay(pose.translation(),
+                Eigen::Vector2d(std::cos(world_angle), std::sin(world_angle)));
+    if (prng != nullptr) {
+      range += std::normal_distribution<double>(0., range_stddev)(*prng);
+    }
+    returns.emplace_back(range * std::cos(angle), range * std::sin(angle), 0.f);
+  }
+  return returns;
+}
+
+}  // namespace
+
+// lua_parameter_dictionary_test_helpers.h defines non-inline functions, so it
+// must not be included by any other translation unit of the benchmarks.
+std::unique_ptr<common::LuaParameterDictionary> MakeDictionary(
+    const std::string& code) {
+  return common::LuaParameterDictionary::NonReferenceCounted(
+      code, absl::make_unique<common::DummyFileResolver>());
+}
+
+std::unique_ptr<common::LuaParameterDictionary> ResolveLuaParameters(
+    const std::string& code) {
+  // An empty list falls back to CARTOGRAPHER_CONFIGURATION_FILES_DIRECTORY,
+  // which the super-build points at the source tree.
+  return common::LuaParameterDictionary::NonReferenceCounted(
+      code, absl::make_unique<common::ConfigurationFileResolver>(
+                std::vector<std::string>()));
+}
+
+std::vector<transform::Rigid2d> GenerateSyntheticTrajectory(
+    const int num_poses) {
+  std::vector<transform::Rigid2d> poses;
+  poses.reserve(num_poses);
+  for (int i = 0; i != num_poses; ++i) {
+    // Advance 5 cm per pose and keep facing along the circle.
+    const double angle = 0.05 * i / kTrajectoryRadius;
+    poses.emplace_back(
+        Eigen::Vector2d(kTrajectoryRadius * std::cos(angle),
+                        kTrajectoryRadius * std::sin(angle)),
+        common::NormalizeAngleDifference(angle + M_PI / 2.));
+  }
+  return poses;
+}
+
+sensor::PointCloud GenerateSyntheticScan(const transform::Rigid2d& pose,
+                                         const int num_points) {
+  sensor::PointCloud point_cloud;
+  for (const Eigen::Vector3f& position : CastScan(pose, num_points)) {
+    point_cloud.push_back({position});
+  }
+  return point_cloud;
+}
+
+sensor::TimedPointCloud GenerateSyntheticTimedScan(
+    const transform::Rigid2d& pose, const int num_points,
+    const double range_stddev, std::mt19937* const prng) {
+  sensor::TimedPointCloud point_cloud;
+  point_cloud.reserve(num_points);
+  for (const Eigen::Vector3f& position :
+       CastScan(pose, num_points, range_stddev, prng)) {
+    point_cloud.push_back({position, 0.f});
+  }
+  return point_cloud;
+}
+
+sensor::RangeData GenerateSyntheticRangeData(const transform::Rigid2d& pose,
+                                             const int num_points) {
+  const transform::Rigid3f pose_3d = transform::Embed3D(pose.cast<float>());
+  sensor::RangeData range_data;
+  range_data.origin = pose_3d.translation();
+  for (const Eigen::Vector3f& position : CastScan(pose, num_points)) {
+    range_data.returns.push_back({pose_3d * position});
+  }
+  return range_data;
+}
+
+sensor::PointCloud GenerateSynthetic3DPointCloud(
+    const int num_layers, const int num_points_per_layer) {
+  sensor::PointCloud point_cloud;
+  for (int layer = 0; layer != num_layers; ++layer) {
+    // Rotate each layer a bit so that points do not line up in z.
+    const transform::Rigid2d pose =
+        transform::Rigid2d::Rotation(0.01 * layer);
+    const float z = 0.1f * layer;
+    for (const Eigen::Vector3f& position :
+         CastScan(pose, num_points_per_layer)) {
+      point_cloud.push_back({Eigen::Vector3f(position.x(), position.y(), z)});
+    }
+  }
+  return point_cloud;
+}
+
+std::unique_ptr<mapping::ProbabilityGrid> CreateSubmapSizedProbabilityGrid(
+    const double resolution,
+    mapping::ValueConversionTables* conversion_tables) {
+  return absl::make_unique<mapping::ProbabilityGrid>(
+      mapping::MapLimits(resolution,
+                         0.5 * kInitialSubmapSize * resolution *
+                             Eigen::Vector2d::Ones(),
+                         mapping::CellLimits(kInitialSubmapSize,
+                                             kInitialSubmapSize)),
+      conversion_tables);
+}
+
+std::unique_ptr<mapping::ProbabilityGrid> GenerateSyntheticProbabilityGrid(
+    const double resolution, const int num_range_data,
+    mapping::ValueConversionTables* conversion_tables) {
+  // A square with a margin of one meter around the room.
+  const double size = std::max(kMaxX - kMinX, kMaxY - kMinY) + 2.;
+  const int num_cells = common::RoundToInt(size / resolution);
+  auto grid = absl::make_unique<mapping::ProbabilityGrid>(
+      mapping::MapLimits(resolution, Eigen::Vector2d(kMaxX + 1., kMaxY + 1.),
+                         mapping::CellLimits(num_cells, num_cells)),
+      conversion_tables);
+  auto parameter_dictionary = MakeDictionary(R"text(
+      return {
+        insert_free_space = true,
+        hit_probability = 0.55,
+        miss_probability = 0.49,
+      })text");
+  const mapping::ProbabilityGridRangeDataInserter2D range_data_inserter(
+      mapping::CreateProbabilityGridRangeDataInserterOptions2D(
+          parameter_dictionary.get()));
+  for (const transform::Rigid2d& pose :
+       GenerateSyntheticTrajectory(num_range_data)) {
+    range_data_inserter.Insert(GenerateSyntheticRangeData(pose, 720),
+                               grid.get());
+    grid->FinishUpdate();
+  }
+  return grid;
+}
+
+}  // namespace benchmarks
+}  // namespace cartographer
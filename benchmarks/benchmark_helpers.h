@@ -0,0 +1,69 @@
+#ifndef CARTOGRAPHER_SUPERBUILD_BENCHMARKS_BENCHMARK_HELPERS_H_
+#define CARTOGRAPHER_SUPERBUILD_BENCHMARKS_BENCHMARK_HELPERS_H_
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "cartographer/common/lua_parameter_dictionary.h"
+#include "cartographer/mapping/2d/probability_grid.h"
+#include "cartographer/mapping/value_conversion_tables.h"
+#include "cartographer/sensor/point_cloud.h"
+#include "cartographer/sensor/range_data.h"
+#include "cartographer/sensor/timed_point_cloud_data.h"
+#include "cartographer/transform/rigid_transform.h"
+
+namespace cartographer {
+namespace benchmarks {
+
+// All inputs are generated from a fixed, asymmetric synthetic room (walls and
+// a few round pillars). Noise, where requested, is drawn from a generator with
+// a fixed seed, so that numbers are comparable between revisions built in the
+// same tree.
+
+// Parses 'code' which must not include any other Lua files.
+std::unique_ptr<common::LuaParameterDictionary> MakeDictionary(
+    const std::string& code);
+
+// Parses 'code' which may include the libcartographer configuration files.
+std::unique_ptr<common::LuaParameterDictionary> ResolveLuaParameters(
+    const std::string& code);
+
+// Returns 'num_poses' poses on a circle through the free space of the room.
+std::vector<transform::Rigid2d> GenerateSyntheticTrajectory(int num_poses);
+
+// Returns a 360 degree scan with 'num_points' returns taken at 'pose', in the
+// sensor frame.
+sensor::PointCloud GenerateSyntheticScan(const transform::Rigid2d& pose,
+                                         int num_points);
+
+// Same as above, with all returns measured at the time of the last return and
+// Gaussian noise with 'range_stddev' added to every range.
+sensor::TimedPointCloud GenerateSyntheticTimedScan(
+    const transform::Rigid2d& pose, int num_points, double range_stddev,
+    std::mt19937* prng);
+
+// Same as above, with returns and origin in the map frame.
+sensor::RangeData GenerateSyntheticRangeData(const transform::Rigid2d& pose,
+                                             int num_points);
+
+// Returns 'num_layers' stacked scans, 0.1 m apart in z, taken at the origin.
+sensor::PointCloud GenerateSynthetic3DPointCloud(int num_layers,
+                                                 int num_points_per_layer);
+
+// Returns an empty grid centered at the origin with the initial size of a
+// Submap2D grid, which has to grow to hold the room.
+std::unique_ptr<mapping::ProbabilityGrid> CreateSubmapSizedProbabilityGrid(
+    double resolution, mapping::ValueConversionTables* conversion_tables);
+
+// Returns a grid covering the whole room with the scans of
+// 'num_range_data' poses of the synthetic trajectory inserted.
+std::unique_ptr<mapping::ProbabilityGrid> GenerateSyntheticProbabilityGrid(
+    double resolution, int num_range_data,
+    mapping::ValueConversionTables* conversion_tables);
+
+}  // namespace benchmarks
+}  // namespace cartographer
+
+#endif  // CARTOGRAPHER_SUPERBUILD_BENCHMARKS_BENCHMARK_HELPERS_H_
@@ -0,0 +1,14 @@
+#include "benchmark/benchmark.h"
+#include "glog/logging.h"
+#include "pose_graph_benchmark.h"
+
+int main(int argc, char** argv) {
+  google::InitGoogleLogging(argv[0]);
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  ::cartographer::benchmarks::RegisterRecordedPoseGraphBenchmarks();
+  ::benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
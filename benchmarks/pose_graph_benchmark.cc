@@ -0,0 +1,203 @@
+#include "pose_graph_benchmark.h"
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+
+#include "absl/memory/memory.h"
+#include "benchmark/benchmark.h"
+#include "benchmark_helpers.h"
+#include "cartographer/common/time.h"
+#include "cartographer/io/proto_stream.h"
+#include "cartographer/io/proto_stream_deserializer.h"
+#include "cartographer/mapping/map_builder.h"
+#include "cartographer/mapping/proto/serialization.pb.h"
+#include "cartographer/mapping/trajectory_builder_interface.h"
+#include "glog/logging.h"
+
+namespace cartographer {
+namespace benchmarks {
+namespace {
+
+using SensorId = mapping::TrajectoryBuilderInterface::SensorId;
+
+const char kRangeSensorId[] = "range";
+// Set to a .pbstream file of a 2D map to also benchmark the optimization of a
+// recorded, non-frozen pose graph.
+const char kPbstreamEnvironmentVariable[] = "CARTOGRAPHER_BENCHMARK_PBSTREAM";
+constexpr double kRangeStddev = 0.03;
+
+// With 'drain_only' set, RunFinalOptimization() waits for all pending
+// constraint searches but the solver runs no iterations.
+std::unique_ptr<common::LuaParameterDictionary> CreateOptions(
+    const bool drain_only) {
+  std::string code = R"text(
+      include "map_builder.lua"
+      include "trajectory_builder.lua"
+      MAP_BUILDER.use_trajectory_builder_2d = true
+      MAP_BUILDER.pose_graph.optimize_every_n_nodes = 0
+      TRAJECTORY_BUILDER_2D.use_imu_data = false
+      TRAJECTORY_BUILDER_2D.num_accumulated_range_data = 1
+      TRAJECTORY_BUILDER_2D.submaps.num_range_data = 20
+  )text";
+  if (drain_only) {
+    code += "MAP_BUILDER.pose_graph.max_num_final_iterations = 0\n";
+  }
+  code += R"text(
+      return {
+        map_builder = MAP_BUILDER,
+        trajectory_builder = TRAJECTORY_BUILDER,
+      })text";
+  return ResolveLuaParameters(code);
+}
+
+std::unique_ptr<mapping::MapBuilder> CreateMapBuilder(
+    common::LuaParameterDictionary* options) {
+  return absl::make_unique<mapping::MapBuilder>(
+      mapping::CreateMapBuilderOptions(
+          options->GetDictionary("map_builder").get()));
+}
+
+// Runs the noisy synthetic trajectory with 'num_nodes' scans through local
+// SLAM and the constraint search and writes the resulting pose graph to a
+// temporary file. The graph has never been optimized, since intermediate
+// optimizations are disabled and the final one runs no iterations.
+std::string WriteUnoptimizedSyntheticState(const int num_nodes) {
+  auto options = CreateOptions(true /* drain_only */);
+  auto map_builder = CreateMapBuilder(options.get());
+  const int trajectory_id = map_builder->AddTrajectoryBuilder(
+      {SensorId{SensorId::SensorType::RANGE, kRangeSensorId}},
+      mapping::CreateTrajectoryBuilderOptions(
+          options->GetDictionary("trajectory_builder").get()),
+      nullptr /* local_slam_result_callback */);
+  mapping::TrajectoryBuilderInterface* const trajectory_builder =
+      map_builder->GetTrajectoryBuilder(trajectory_id);
+  const common::Time start_time = common::FromUniversal(1000000);
+  std::mt19937 prng(42);
+  int i = 0;
+  for (const transform::Rigid2d& pose :
+       GenerateSyntheticTrajectory(num_nodes)) {
+    trajectory_builder->AddSensorData(
+        kRangeSensorId,
+        sensor::TimedPointCloudData{
+            start_time + common::FromSeconds(0.1 * i++),
+            Eigen::Vector3f::Zero(),
+            GenerateSyntheticTimedScan(pose, 720, kRangeStddev, &prng)});
+  }
+  map_builder->FinishTrajectory(trajectory_id);
+  map_builder->pose_graph()->RunFinalOptimization();
+
+  char filename[] = "/tmp/cartographer_benchmarks_XXXXXX";
+  const int fd = mkstemp(filename);
+  CHECK_NE(fd, -1) << "Could not create a temporary file.";
+  close(fd);
+  CHECK(map_builder->SerializeStateToFile(
+      true /* include_unfinished_submaps */, filename));
+  return filename;
+}
+
+struct SerializedStateInfo {
+  size_t num_trajectory_nodes = 0;
+  size_t num_constraints = 0;
+  bool first_submap_is_3d = false;
+};
+
+SerializedStateInfo ReadSerializedStateInfo(const std::string& filename) {
+  io::ProtoStreamReader reader(filename);
+  io::ProtoStreamDeserializer deserializer(&reader);
+  SerializedStateInfo info;
+  info.num_constraints = deserializer.pose_graph().constraint_size();
+  for (const auto& trajectory : deserializer.pose_graph().trajectory()) {
+    info.num_trajectory_nodes += trajectory.node_size();
+  }
+  mapping::proto::SerializedData serialized_data;
+  while (deserializer.ReadNextSerializedData(&serialized_data)) {
+    if (serialized_data.has_submap()) {
+      info.first_submap_is_3d = serialized_data.submap().has_submap_3d();
+      break;
+    }
+  }
+  return info;
+}
+
+// LoadStateFromFile() only queues work items, but the first one already
+// schedules draining the work queue on the pose graph's thread pool. The
+// serialized constraints are added by the last work item, so once all nodes
+// and constraints are present the loaded state has been fully applied.
+void WaitForLoadedState(const SerializedStateInfo& info,
+                        mapping::MapBuilder* const map_builder) {
+  while (map_builder->pose_graph()->GetTrajectoryNodePoses().size() !=
+             info.num_trajectory_nodes ||
+         map_builder->pose_graph()->constraints().size() !=
+             info.num_constraints) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+// Times the first RunFinalOptimization() after loading 'filename' into a new
+// map builder. Loading, applying the loaded state and destroying map builders
+// is not timed.
+void BenchmarkFirstFinalOptimization(benchmark::State& state,
+                                     const std::string& filename) {
+  const SerializedStateInfo info = ReadSerializedStateInfo(filename);
+  auto options = CreateOptions(false /* drain_only */);
+  std::unique_ptr<mapping::MapBuilder> map_builder;
+  for (auto _ : state) {
+    state.PauseTiming();
+    map_builder = CreateMapBuilder(options.get());
+    map_builder->LoadStateFromFile(filename, false /* load_frozen_state */);
+    WaitForLoadedState(info, map_builder.get());
+    state.ResumeTiming();
+    map_builder->pose_graph()->RunFinalOptimization();
+  }
+  state.counters["nodes"] = info.num_trajectory_nodes;
+  state.counters["constraints"] = info.num_constraints;
+}
+
+// Arguments: number of nodes.
+void BM_PoseGraph2DRunFinalOptimization(benchmark::State& state) {
+  const std::string filename = WriteUnoptimizedSyntheticState(state.range(0));
+  BenchmarkFirstFinalOptimization(state, filename);
+  std::remove(filename.c_str());
+}
+BENCHMARK(BM_PoseGraph2DRunFinalOptimization)
+    ->Arg(200)
+    ->Arg(800)
+    ->Iterations(5)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+
+void RegisterRecordedPoseGraphBenchmarks() {
+  const char* const filename = std::getenv(kPbstreamEnvironmentVariable);
+  if (filename == nullptr) {
+    return;
+  }
+  const std::string path(filename);
+  // The map builder is set up for 2D only and would CHECK-fail deep inside
+  // PoseGraph2D when loading 3D submaps.
+  if (ReadSerializedStateInfo(path).first_submap_is_3d) {
+    LOG(FATAL) << kPbstreamEnvironmentVariable << "=" << path
+               << " contains a 3D map, only 2D maps can be benchmarked.";
+  }
+  const std::string basename = path.substr(path.find_last_of('/') + 1);
+  // A recorded pbstream has already been optimized, so this measures a warm
+  // re-solve. It is named after the map so that results from different maps
+  // do not end up being compared.
+  benchmark::RegisterBenchmark(
+      ("BM_PoseGraph2DWarmReSolve/" + basename).c_str(),
+      BenchmarkFirstFinalOptimization, path)
+      ->Iterations(3)
+      ->UseRealTime()
+      ->Unit(benchmark::kMillisecond);
+}
+
+}  // namespace benchmarks
+}  // namespace cartographer
@@ -0,0 +1,15 @@
+#ifndef CARTOGRAPHER_SUPERBUILD_BENCHMARKS_POSE_GRAPH_BENCHMARK_H_
+#define CARTOGRAPHER_SUPERBUILD_BENCHMARKS_POSE_GRAPH_BENCHMARK_H_
+
+namespace cartographer {
+namespace benchmarks {
+
+// Registers a benchmark for the .pbstream file given by
+// CARTOGRAPHER_BENCHMARK_PBSTREAM, if set. The file must contain a 2D map.
+// Must be called before running the benchmarks.
+void RegisterRecordedPoseGraphBenchmarks();
+
+}  // namespace benchmarks
+}  // namespace cartographer
+
+#endif  // CARTOGRAPHER_SUPERBUILD_BENCHMARKS_POSE_GRAPH_BENCHMARK_H_
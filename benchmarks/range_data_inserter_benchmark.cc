@@ -0,0 +1,83 @@
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helpers.h"
+#include "cartographer/mapping/2d/probability_grid_range_data_inserter_2d.h"
+
+namespace cartographer {
+namespace benchmarks {
+namespace {
+
+constexpr double kResolution = 0.05;
+constexpr int kNumPointsPerScan = 720;
+
+mapping::proto::ProbabilityGridRangeDataInserterOptions2D
+CreateRangeDataInserterOptions(const bool insert_free_space) {
+  auto parameter_dictionary = MakeDictionary(
+      std::string("return { insert_free_space = ") +
+      (insert_free_space ? "true" : "false") +
+      ", hit_probability = 0.55, miss_probability = 0.49, }");
+  return mapping::CreateProbabilityGridRangeDataInserterOptions2D(
+      parameter_dictionary.get());
+}
+
+// Arguments: number of points in the scan, whether to insert free space.
+void BM_ProbabilityGridRangeDataInserter2DInsert(benchmark::State& state) {
+  mapping::ValueConversionTables conversion_tables;
+  // Start from an empty grid which already covers the whole room, so that only
+  // ray casting and cell updates are measured. See below for growth.
+  const auto grid = GenerateSyntheticProbabilityGrid(
+      kResolution, 0 /* num_range_data */, &conversion_tables);
+  const mapping::ProbabilityGridRangeDataInserter2D range_data_inserter(
+      CreateRangeDataInserterOptions(state.range(1)));
+  const sensor::RangeData range_data = GenerateSyntheticRangeData(
+      GenerateSyntheticTrajectory(1).front(), state.range(0));
+  for (auto _ : state) {
+    range_data_inserter.Insert(range_data, grid.get());
+    grid->FinishUpdate();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ProbabilityGridRangeDataInserter2DInsert)
+    ->Args({360, 0})
+    ->Args({360, 1})
+    ->Args({1440, 1})
+    ->Unit(benchmark::kMicrosecond);
+
+// Submap2D grids start small and GrowLimits() is called whenever inserted
+// range data does not fit. Every iteration starts from a fresh grid of the
+// initial submap size and inserts the given number of scans of the
+// trajectory, so the timings include all growth of a submap's lifetime.
+//
+// Arguments: number of scans inserted into the grid.
+void BM_ProbabilityGridRangeDataInserter2DInsertWithGrowth(
+    benchmark::State& state) {
+  mapping::ValueConversionTables conversion_tables;
+  const mapping::ProbabilityGridRangeDataInserter2D range_data_inserter(
+      CreateRangeDataInserterOptions(true /* insert_free_space */));
+  std::vector<sensor::RangeData> range_data;
+  for (const transform::Rigid2d& pose :
+       GenerateSyntheticTrajectory(state.range(0))) {
+    range_data.push_back(GenerateSyntheticRangeData(pose, kNumPointsPerScan));
+  }
+  for (auto _ : state) {
+    const auto grid =
+        CreateSubmapSizedProbabilityGrid(kResolution, &conversion_tables);
+    for (const sensor::RangeData& scan : range_data) {
+      range_data_inserter.Insert(scan, grid.get());
+      grid->FinishUpdate();
+    }
+    benchmark::DoNotOptimize(grid->limits());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) *
+                          kNumPointsPerScan);
+}
+BENCHMARK(BM_ProbabilityGridRangeDataInserter2DInsertWithGrowth)
+    ->Arg(1)
+    ->Arg(90)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace cartographer
@@ -0,0 +1,128 @@
+#include "benchmark/benchmark.h"
+#include "benchmark_helpers.h"
+#include "cartographer/mapping/internal/2d/scan_matching/ceres_scan_matcher_2d.h"
+#include "cartographer/mapping/internal/2d/scan_matching/fast_correlative_scan_matcher_2d.h"
+
+namespace cartographer {
+namespace benchmarks {
+namespace {
+
+constexpr double kResolution = 0.05;
+constexpr int kNumRangeDataInGrid = 60;
+constexpr float kMinScore = 0.1f;
+
+mapping::scan_matching::proto::FastCorrelativeScanMatcherOptions2D
+CreateFastCorrelativeScanMatcherOptions() {
+  auto parameter_dictionary = MakeDictionary(R"text(
+      return {
+        linear_search_window = 3.,
+        angular_search_window = math.rad(30.),
+        branch_and_bound_depth = 7,
+      })text");
+  return mapping::scan_matching::CreateFastCorrelativeScanMatcherOptions2D(
+      parameter_dictionary.get());
+}
+
+mapping::scan_matching::proto::CeresScanMatcherOptions2D
+CreateCeresScanMatcherOptions() {
+  auto parameter_dictionary = MakeDictionary(R"text(
+      return {
+        occupied_space_weight = 1.,
+        translation_weight = 10.,
+        rotation_weight = 40.,
+        ceres_solver_options = {
+          use_nonmonotonic_steps = false,
+          max_num_iterations = 20,
+          num_threads = 1,
+        },
+      })text");
+  return mapping::scan_matching::CreateCeresScanMatcherOptions2D(
+      parameter_dictionary.get());
+}
+
+// The scan is taken at a pose of the trajectory used to build the grid, the
+// search starts from a perturbed pose.
+const transform::Rigid2d& ExpectedPose() {
+  static const transform::Rigid2d* const kPose = new transform::Rigid2d(
+      GenerateSyntheticTrajectory(kNumRangeDataInGrid / 2).back());
+  return *kPose;
+}
+
+transform::Rigid2d PerturbedPose(const double translation,
+                                 const double rotation) {
+  return transform::Rigid2d(Eigen::Vector2d(translation, -translation),
+                            rotation) *
+         ExpectedPose();
+}
+
+// Arguments: number of points in the scan.
+void BM_FastCorrelativeScanMatcher2DMatch(benchmark::State& state) {
+  mapping::ValueConversionTables conversion_tables;
+  const auto grid = GenerateSyntheticProbabilityGrid(
+      kResolution, kNumRangeDataInGrid, &conversion_tables);
+  const mapping::scan_matching::FastCorrelativeScanMatcher2D scan_matcher(
+      *grid, CreateFastCorrelativeScanMatcherOptions());
+  const sensor::PointCloud point_cloud =
+      GenerateSyntheticScan(ExpectedPose(), state.range(0));
+  const transform::Rigid2d initial_pose_estimate = PerturbedPose(0.5, 0.1);
+  for (auto _ : state) {
+    float score;
+    transform::Rigid2d pose_estimate;
+    benchmark::DoNotOptimize(scan_matcher.Match(initial_pose_estimate,
+                                                point_cloud, kMinScore,
+                                                &score, &pose_estimate));
+  }
+}
+BENCHMARK(BM_FastCorrelativeScanMatcher2DMatch)
+    ->Arg(360)
+    ->Arg(1440)
+    ->Unit(benchmark::kMillisecond);
+
+// Arguments: number of points in the scan.
+void BM_FastCorrelativeScanMatcher2DMatchFullSubmap(benchmark::State& state) {
+  mapping::ValueConversionTables conversion_tables;
+  const auto grid = GenerateSyntheticProbabilityGrid(
+      kResolution, kNumRangeDataInGrid, &conversion_tables);
+  const mapping::scan_matching::FastCorrelativeScanMatcher2D scan_matcher(
+      *grid, CreateFastCorrelativeScanMatcherOptions());
+  const sensor::PointCloud point_cloud =
+      GenerateSyntheticScan(ExpectedPose(), state.range(0));
+  for (auto _ : state) {
+    float score;
+    transform::Rigid2d pose_estimate;
+    benchmark::DoNotOptimize(scan_matcher.MatchFullSubmap(
+        point_cloud, kMinScore, &score, &pose_estimate));
+  }
+}
+BENCHMARK(BM_FastCorrelativeScanMatcher2DMatchFullSubmap)
+    ->Arg(360)
+    ->Arg(1440)
+    ->Unit(benchmark::kMillisecond);
+
+// Arguments: number of points in the scan.
+void BM_CeresScanMatcher2DMatch(benchmark::State& state) {
+  mapping::ValueConversionTables conversion_tables;
+  const auto grid = GenerateSyntheticProbabilityGrid(
+      kResolution, kNumRangeDataInGrid, &conversion_tables);
+  const mapping::scan_matching::CeresScanMatcher2D scan_matcher(
+      CreateCeresScanMatcherOptions());
+  const sensor::PointCloud point_cloud =
+      GenerateSyntheticScan(ExpectedPose(), state.range(0));
+  const transform::Rigid2d initial_pose_estimate = PerturbedPose(0.05, 0.02);
+  for (auto _ : state) {
+    transform::Rigid2d pose_estimate;
+    ceres::Solver::Summary summary;
+    scan_matcher.Match(initial_pose_estimate.translation(),
+                       initial_pose_estimate, point_cloud, *grid,
+                       &pose_estimate, &summary);
+    benchmark::DoNotOptimize(pose_estimate);
+  }
+}
+BENCHMARK(BM_CeresScanMatcher2DMatch)
+    ->Arg(360)
+    ->Arg(1440)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace cartographer
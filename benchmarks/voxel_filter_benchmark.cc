@@ -0,0 +1,53 @@
+#include "benchmark/benchmark.h"
+#include "benchmark_helpers.h"
+#include "cartographer/sensor/internal/voxel_filter.h"
+
+namespace cartographer {
+namespace benchmarks {
+namespace {
+
+constexpr int kNumPointsPerLayer = 2048;
+
+// Arguments: number of layers, voxel size in millimeters.
+void BM_VoxelFilter(benchmark::State& state) {
+  const sensor::PointCloud point_cloud =
+      GenerateSynthetic3DPointCloud(state.range(0), kNumPointsPerLayer);
+  const float resolution = 1e-3f * state.range(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sensor::VoxelFilter(point_cloud, resolution));
+  }
+  state.SetItemsProcessed(state.iterations() * point_cloud.size());
+}
+BENCHMARK(BM_VoxelFilter)
+    ->Args({1, 25})
+    ->Args({16, 50})
+    ->Args({64, 100})
+    ->Unit(benchmark::kMicrosecond);
+
+// Arguments: number of layers.
+void BM_AdaptiveVoxelFilter(benchmark::State& state) {
+  const sensor::PointCloud point_cloud =
+      GenerateSynthetic3DPointCloud(state.range(0), kNumPointsPerLayer);
+  // Same as TRAJECTORY_BUILDER_2D.adaptive_voxel_filter.
+  auto parameter_dictionary = MakeDictionary(R"text(
+      return {
+        max_length = 0.5,
+        min_num_points = 200,
+        max_range = 50.,
+      })text");
+  const sensor::proto::AdaptiveVoxelFilterOptions options =
+      sensor::CreateAdaptiveVoxelFilterOptions(parameter_dictionary.get());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sensor::AdaptiveVoxelFilter(point_cloud, options));
+  }
+  state.SetItemsProcessed(state.iterations() * point_cloud.size());
+}
+BENCHMARK(BM_AdaptiveVoxelFilter)
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(64)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace cartographer